@@ -10,12 +10,22 @@
 #include <string.h>
 #include <stdio.h>
 
+// Optional modules - define before including to compile them in, so
+// programs only pay in flash for what they use:
+//   PACKET_ATOMS_FRAMING - jet_frame(), jet_tiny_n(), jet_n()
+//   PACKET_ATOMS_CHANGED - jet_changed()
+//   PACKET_ATOMS_FOREACH - jet_foreach()
+//   PACKET_ATOMS_RT      - jet_tiny_rt()
+//   PACKET_ATOMS_BLOB    - jet_hex(), jet_b64()
+
 // Error codes
 typedef enum {
     JET_OK = 0,
     JET_KEY_MISSING,
     JET_MALFORMED,
-    JET_TRUNCATED
+    JET_TRUNCATED,
+    JET_BUDGET_EXCEEDED,
+    JET_BAD_ENCODING
 } jet_err;
 
 /* jet_tiny - Core field extractor
@@ -41,7 +51,7 @@ typedef enum {
  *   JET_TRUNCATED   - Value too large for buffer
  */
 jet_err jet_tiny(const char *j, const char *needle, char *v, size_t vmax) {
-    char *p = strstr(j, needle);
+    const char *p = strstr(j, needle);
     if (!p) return JET_KEY_MISSING;
     
     p += strlen(needle);
@@ -87,6 +97,141 @@ jet_err jet(const char *j, const char *k, char *v, size_t vmax) {
     return jet_tiny(j, needle, v, vmax);
 }
 
+#ifdef PACKET_ATOMS_RT
+
+/* jet_tiny_rt - Bounded-time field extractor for real-time tasks
+ *
+ * Same rules as jet_tiny(), but reads no byte at or past j + budget, so a
+ * huge or unterminated message cannot overrun the deadline. No libc
+ * calls besides strlen(needle); worst case is budget * strlen(needle)
+ * byte compares, whatever the input.
+ *
+ * PARAMS:
+ *   j      - JSON string to parse (scan stops at NUL or budget)
+ *   needle - Search pattern (e.g., "\"temp\":")
+ *   v      - Output buffer for extracted value
+ *   vmax   - Size of output buffer
+ *   budget - Max bytes of j to examine
+ *
+ * RETURNS:
+ *   JET_BUDGET_EXCEEDED - Budget used up before key and value end found
+ *   JET_MALFORMED       - Empty value, or empty needle
+ *   (other codes as jet_tiny)
+ *
+ * EXAMPLE:
+ *   char temp[16];
+ *   if (jet_tiny_rt(rx, "\"temp\":", temp, sizeof(temp), 256) != JET_OK) drop();
+ */
+jet_err jet_tiny_rt(const char *j, const char *needle, char *v, size_t vmax, size_t budget) {
+    size_t nlen = strlen(needle);
+    size_t i, k;
+    if (nlen == 0) return JET_MALFORMED;
+
+    for (i = 0; ; i++) {
+        if (i >= budget) return JET_BUDGET_EXCEEDED;
+        if (!j[i]) return JET_KEY_MISSING;
+        for (k = 0; k < nlen && i + k < budget && j[i + k] == needle[k]; k++) {}
+        if (k == nlen) break;
+    }
+
+    i += nlen;
+    while (i < budget && j[i] == ' ') i++;  // Skip optional spaces
+
+    size_t n = 0;
+    while (i < budget && j[i] && j[i] != ',' && j[i] != '}' && n < vmax - 1) {
+        v[n++] = j[i++];
+    }
+    v[n] = '\0';
+
+    if (i >= budget) return JET_BUDGET_EXCEEDED;  // Value end not seen
+    if (n == 0) return JET_MALFORMED;
+    if (j[i] && j[i] != ',' && j[i] != '}') return JET_TRUNCATED;
+
+    return JET_OK;
+}
+
+#endif // PACKET_ATOMS_RT
+
+#if defined(PACKET_ATOMS_FRAMING) || defined(PACKET_ATOMS_CHANGED)
+
+/* jet_find_n - Bounded substring search
+ *
+ * memchr() for the first needle byte, memcmp() for the rest.
+ *
+ * RETURNS:
+ *   Pointer to first match in [p, end), or NULL (nlen must be > 0)
+ */
+static const char* jet_find_n(const char *p, const char *end, const char *needle, size_t nlen) {
+    for (;;) {
+        if ((size_t)(end - p) < nlen) return NULL;
+        p = (const char *)memchr(p, needle[0], (size_t)(end - p) - nlen + 1);
+        if (!p) return NULL;
+        if (memcmp(p, needle, nlen) == 0) return p;
+        p++;
+    }
+}
+
+#endif
+
+#ifdef PACKET_ATOMS_FRAMING
+
+/* jet_tiny_n - Length-bounded field extractor
+ *
+ * Same rules as jet_tiny(), but never reads past j + jlen and does not
+ * need a NUL terminator. Use it on records returned by jet_frame() so a
+ * key missing from one message cannot match the next one in the buffer.
+ *
+ * PARAMS:
+ *   j      - Start of record (not necessarily NUL-terminated)
+ *   jlen   - Record length in bytes
+ *   needle - Search pattern (e.g., "\"temp\":")
+ *   v      - Output buffer for extracted value
+ *   vmax   - Size of output buffer
+ *
+ * RETURNS:
+ *   JET_MALFORMED - If needle is empty
+ *   (other codes as jet_tiny)
+ */
+jet_err jet_tiny_n(const char *j, size_t jlen, const char *needle, char *v, size_t vmax) {
+    const char *end = j + jlen;
+    size_t nlen = strlen(needle);
+    if (nlen == 0) return JET_MALFORMED;
+
+    const char *p = jet_find_n(j, end, needle, nlen);
+    if (!p) return JET_KEY_MISSING;
+
+    p += nlen;
+    while (p < end && *p == ' ') p++;  // Skip optional spaces
+
+    size_t n = 0;
+    while (p < end && *p != ',' && *p != '}' && n < vmax - 1) {
+        v[n++] = *p++;
+    }
+    v[n] = '\0';
+
+    if (n == 0) return JET_MALFORMED;
+    if (p < end && *p != ',' && *p != '}') return JET_TRUNCATED;
+
+    return JET_OK;
+}
+
+/* jet_n - Length-bounded convenience wrapper
+ *
+ * jet() for records that are not NUL-terminated (see jet_tiny_n).
+ *
+ * RETURNS:
+ *   JET_MALFORMED - If key name exceeds 60 characters
+ *   (other codes from jet_tiny_n)
+ */
+jet_err jet_n(const char *j, size_t jlen, const char *k, char *v, size_t vmax) {
+    char needle[64];
+    int n = snprintf(needle, sizeof(needle), "\"%s\":", k);
+    if (n >= (int)sizeof(needle)) return JET_MALFORMED;  // Key too long
+    return jet_tiny_n(j, jlen, needle, v, vmax);
+}
+
+#endif // PACKET_ATOMS_FRAMING
+
 /* tlv - Binary TLV walker
  * Compiled size: 42 bytes (ARM Cortex-M4 -Os), 55 bytes (x86-64 -Os)
  *
@@ -123,4 +268,799 @@ uint8_t* tlv(uint8_t *buf, size_t buf_len, uint8_t tag, uint16_t *len) {
     return buf + 2;
 }
 
+#if defined(PACKET_ATOMS_CHANGED) || defined(PACKET_ATOMS_FOREACH)
+
+/* jet_skip_str - Skip string at p (on opening quote)
+ *
+ * RETURNS:
+ *   Pointer past closing quote, or NULL if input ends first
+ */
+static const char* jet_skip_str(const char *p, const char *end) {
+    for (p++; p < end; p++) {
+        if (*p == '\\') {
+            if (++p == end) break;  // Escape at end of input
+        } else if (*p == '"') {
+            return p + 1;
+        }
+    }
+    return NULL;
+}
+
+/* jet_skip_nested - Skip object/array at p (on '{' or '[')
+ *
+ * Counts brackets outside strings; bracket kinds are checked when
+ * jet_foreach() descends into the value.
+ *
+ * RETURNS:
+ *   Pointer past matching close, or NULL if input ends first
+ */
+static const char* jet_skip_nested(const char *p, const char *end) {
+    size_t depth = 0;
+    while (p < end) {
+        if (*p == '"') {
+            p = jet_skip_str(p, end);
+            if (!p) return NULL;
+            continue;
+        }
+        if (*p == '{' || *p == '[') depth++;
+        else if ((*p == '}' || *p == ']') && --depth == 0) return p + 1;
+        p++;
+    }
+    return NULL;
+}
+
+#endif
+
+#ifdef PACKET_ATOMS_CHANGED
+
+/* jet_fp - Per-field fingerprints of the previous message
+ *
+ * Caller-owned, zero-initialize before first use. 4 bytes per field plus
+ * a presence mask; define JET_FP_MAX (max 32) before including to resize.
+ */
+#ifndef JET_FP_MAX
+#define JET_FP_MAX 16
+#endif
+#if JET_FP_MAX > 32
+#error "JET_FP_MAX must be <= 32 (changed-field mask is 32 bits)"
+#endif
+
+typedef struct {
+    uint32_t hash[JET_FP_MAX];  // FNV-1a of each field's raw value bytes
+    uint32_t seen;              // Bit i set: field i was present last call
+} jet_fp;
+
+/* jet_changed - Report which fields changed since the previous message
+ *
+ * Hashes each field's raw value bytes in place (no copy, no numeric
+ * conversion) and compares against the fingerprint kept in fp. Each field
+ * is the first match of its needle in the message, same as jet_tiny_n(),
+ * so field order does not matter. Every field is its own search from the
+ * start of the message: up to n scans per call, not one.
+ *
+ * A string is hashed up to its closing quote and an object or array up
+ * to its matching bracket, so "a,b" -> "a,c" or {"x":1,"y":2} -> y:3
+ * counts as a change. Other values end at ',' or '}'.
+ *
+ * Raw bytes are compared, so "22.5" and "22.50" count as a change.
+ * A field appearing or disappearing counts as a change.
+ *
+ * PARAMS:
+ *   fp      - Fingerprint state, updated in place
+ *   j       - Message (not necessarily NUL-terminated)
+ *   jlen    - Message length in bytes
+ *   needles - Search patterns, one per field (e.g., "\"temp\":")
+ *   n       - Number of fields; fields past JET_FP_MAX are ignored and
+ *             never reported
+ *
+ * RETURNS:
+ *   Bitmask, bit i set if field i changed (0 = message can be dropped)
+ *
+ * EXAMPLE:
+ *   static const char *const fields[] = { "\"temp\":", "\"hum\":" };
+ *   static jet_fp fp;
+ *   if (jet_changed(&fp, msg, len, fields, 2) == 0) return;  // Duplicate
+ */
+uint32_t jet_changed(jet_fp *fp, const char *j, size_t jlen, const char *const *needles, uint8_t n) {
+    const char *end = j + jlen;
+    uint32_t changed = 0;
+    uint32_t seen = 0;
+
+    if (n > JET_FP_MAX) n = JET_FP_MAX;
+
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t bit = (uint32_t)1 << i;
+        size_t nlen = strlen(needles[i]);
+        const char *p = nlen ? jet_find_n(j, end, needles[i], nlen) : NULL;
+
+        if (!p) {
+            if (fp->seen & bit) changed |= bit;
+            continue;
+        }
+
+        p += nlen;
+        while (p < end && *p == ' ') p++;
+
+        const char *v = p;
+        if (p < end && *p == '"') {
+            p = jet_skip_str(p, end);
+        } else if (p < end && (*p == '{' || *p == '[')) {
+            p = jet_skip_nested(p, end);
+        } else {
+            while (p < end && *p && *p != ',' && *p != '}') p++;
+        }
+        if (!p) p = end;  // Unterminated: hash the rest
+
+        uint32_t h = 2166136261u;  // FNV-1a
+        while (v < p) h = (h ^ (uint8_t)*v++) * 16777619u;
+
+        seen |= bit;
+        if (!(fp->seen & bit) || fp->hash[i] != h) changed |= bit;
+        fp->hash[i] = h;
+    }
+
+    fp->seen = seen;
+    return changed;
+}
+
+#endif // PACKET_ATOMS_CHANGED
+
+#ifdef PACKET_ATOMS_BLOB
+
+// Vector decode kernels on hosts; everything else (Cortex-M) uses the
+// table-free scalar loops. NEON is AArch64 only (vmaxvq).
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define JET_BLOB_SSSE3
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define JET_BLOB_NEON
+#endif
+
+/* jet_find_str - Locate a string value
+ *
+ * Finds needle like jet_tiny(), skips optional spaces and expects a
+ * quoted string. No escapes are expected inside (hex/base64 payloads).
+ *
+ * PARAMS:
+ *   j      - JSON string to parse
+ *   needle - Search pattern (e.g., "\"chunk\":")
+ *   s, e   - Output: first byte of string contents, closing quote
+ *
+ * RETURNS:
+ *   JET_OK, JET_KEY_MISSING, or JET_MALFORMED (not a closed string)
+ */
+static jet_err jet_find_str(const char *j, const char *needle, const char **s, const char **e) {
+    const char *p = strstr(j, needle);
+    if (!p) return JET_KEY_MISSING;
+
+    p += strlen(needle);
+    while (*p == ' ') p++;  // Skip optional spaces
+    if (*p != '"') return JET_MALFORMED;
+
+    *s = p + 1;
+    *e = strchr(*s, '"');
+    return *e ? JET_OK : JET_MALFORMED;
+}
+
+#ifdef JET_BLOB_SSSE3
+/* jet_hex_nib - 16 hex digits to nibble values, *bad gets 0xFF lanes for non-digits */
+static __m128i jet_hex_nib(__m128i c, __m128i *bad) {
+    __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);  // d <= 9
+    __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);  // l <= 5
+    *bad = _mm_or_si128(*bad, _mm_andnot_si128(_mm_or_si128(is_d, is_l), _mm_set1_epi8(-1)));
+    return _mm_or_si128(_mm_and_si128(is_d, d),
+                        _mm_andnot_si128(is_d, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+#endif
+
+#ifdef JET_BLOB_NEON
+/* jet_hex_nib - 16 hex digits to nibble values, *bad gets 0xFF lanes for non-digits */
+static uint8x16_t jet_hex_nib(uint8x16_t c, uint8x16_t *bad) {
+    uint8x16_t d = vsubq_u8(c, vdupq_n_u8('0'));
+    uint8x16_t l = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t is_d = vcleq_u8(d, vdupq_n_u8(9));
+    *bad = vorrq_u8(*bad, vbicq_u8(vcgtq_u8(l, vdupq_n_u8(5)), is_d));
+    return vbslq_u8(is_d, d, vaddq_u8(l, vdupq_n_u8(10)));
+}
+#endif
+
+#if defined(JET_BLOB_SSSE3) || defined(JET_BLOB_NEON)
+/* jet_hex_vec - Decode 32-digit blocks, stopping before the first bad one
+ *
+ * RETURNS:
+ *   Digits consumed; the scalar loop decodes the rest and reports errors
+ */
+static size_t jet_hex_vec(const char *s, size_t len, uint8_t *out) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+#ifdef JET_BLOB_SSSE3
+        __m128i bad = _mm_setzero_si128();
+        __m128i a = jet_hex_nib(_mm_loadu_si128((const __m128i *)(s + i)), &bad);
+        __m128i b = jet_hex_nib(_mm_loadu_si128((const __m128i *)(s + i + 16)), &bad);
+        if (_mm_movemask_epi8(bad)) break;
+        __m128i w = _mm_set1_epi16(0x0110);  // hi * 16 + lo per digit pair
+        _mm_storeu_si128((__m128i *)(out + i / 2),
+                         _mm_packus_epi16(_mm_maddubs_epi16(a, w), _mm_maddubs_epi16(b, w)));
+#else
+        uint8x16_t bad = vdupq_n_u8(0);
+        uint8x16x2_t c = vld2q_u8((const uint8_t *)(s + i));  // Even/odd digits
+        uint8x16_t hi = jet_hex_nib(c.val[0], &bad);
+        uint8x16_t lo = jet_hex_nib(c.val[1], &bad);
+        if (vmaxvq_u8(bad)) break;
+        vst1q_u8(out + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+#endif
+    }
+    return i;
+}
+#endif
+
+/* jet_hex - Extract and decode a hex string value
+ *
+ * Decodes {"key":"deadbeef"} straight into out, no intermediate copy.
+ * Upper and lower case digits accepted. Built with SSSE3 or AArch64
+ * NEON, 32-digit blocks go through a vector kernel first.
+ *
+ * IN PLACE:
+ *   out may point into the same (writable) buffer as j, at or before the
+ *   value, e.g. (uint8_t *)json. Output never overtakes input. On error
+ *   the overwritten bytes are left undefined.
+ *
+ * PARAMS:
+ *   j      - JSON string to parse
+ *   needle - Search pattern (e.g., "\"fw\":")
+ *   out    - Output buffer for decoded bytes
+ *   omax   - Size of output buffer
+ *   olen   - Output: number of decoded bytes
+ *
+ * RETURNS:
+ *   JET_OK           - Success
+ *   JET_KEY_MISSING  - Field not found
+ *   JET_MALFORMED    - Value is not a closed string
+ *   JET_TRUNCATED    - Decoded data larger than omax (nothing written)
+ *   JET_BAD_ENCODING - Odd length or non-hex character
+ */
+jet_err jet_hex(const char *j, const char *needle, uint8_t *out, size_t omax, size_t *olen) {
+    const char *s, *e;
+    jet_err err = jet_find_str(j, needle, &s, &e);
+    if (err != JET_OK) return err;
+
+    size_t len = (size_t)(e - s);
+    if (len & 1) return JET_BAD_ENCODING;
+    if (len / 2 > omax) return JET_TRUNCATED;
+
+    size_t n = 0;
+#if defined(JET_BLOB_SSSE3) || defined(JET_BLOB_NEON)
+    n = jet_hex_vec(s, len, out) / 2;
+    s += 2 * n;
+#endif
+    for (; s < e; s += 2) {
+        uint8_t b = 0;
+        for (int k = 0; k < 2; k++) {
+            uint8_t c = (uint8_t)s[k];
+            uint8_t d = (uint8_t)(c - '0');
+            if (d > 9) {
+                d = (uint8_t)((c | 0x20) - 'a');  // Fold to lower case
+                if (d > 5) return JET_BAD_ENCODING;
+                d += 10;
+            }
+            b = (uint8_t)(b << 4 | d);
+        }
+        out[n++] = b;
+    }
+
+    *olen = n;
+    return JET_OK;
+}
+
+/* jet_b64_val - Table-free base64 digit value, or -1 if invalid */
+static int jet_b64_val(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+#ifdef JET_BLOB_SSSE3
+/* jet_b64_vec - Decode 16-character blocks, stopping before the first bad one
+ *
+ * Nibble-lookup validation and translation (pshufb), then maddubs/madd
+ * pack four 6-bit values into 3 bytes per lane.
+ *
+ * RETURNS:
+ *   Characters consumed (whole quads); the scalar loop does the rest
+ */
+static size_t jet_b64_vec(const char *s, size_t len, uint8_t *out) {
+    // Bit set in lut_lo[low nibble] & lut_hi[high nibble] means invalid
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                         0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // Offset to add per high nibble; index 1 is '/' (0x2F)
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                           0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nib = _mm_set1_epi8(0x0F);
+    const __m128i order = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    uint8_t tmp[16];
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i c = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi32(c, 4), nib);
+        __m128i lo = _mm_and_si128(c, nib);
+        __m128i bad = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo), _mm_shuffle_epi8(lut_hi, hi));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bad, _mm_setzero_si128())) != 0xFFFF) break;
+
+        __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8(0x2F));
+        __m128i v = _mm_add_epi8(c, _mm_shuffle_epi8(lut_roll, _mm_add_epi8(slash, hi)));
+        v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));  // a << 6 | b
+        v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));     // ab << 12 | cd
+        _mm_storeu_si128((__m128i *)tmp, _mm_shuffle_epi8(v, order));
+        memcpy(out + i / 4 * 3, tmp, 12);  // Exact 12 bytes: never past omax
+    }
+    return i;
+}
+#endif
+
+#ifdef JET_BLOB_NEON
+/* jet_b64_nib - 16 base64 characters to 6-bit values, 0xFF for invalid */
+static uint8x16_t jet_b64_nib(uint8x16_t c) {
+    uint8x16_t up = vsubq_u8(c, vdupq_n_u8('A'));
+    uint8x16_t lo = vsubq_u8(c, vdupq_n_u8('a'));
+    uint8x16_t dg = vsubq_u8(c, vdupq_n_u8('0'));
+    uint8x16_t v = vdupq_n_u8(0xFF);
+    v = vbslq_u8(vcltq_u8(up, vdupq_n_u8(26)), up, v);
+    v = vbslq_u8(vcltq_u8(lo, vdupq_n_u8(26)), vaddq_u8(lo, vdupq_n_u8(26)), v);
+    v = vbslq_u8(vcltq_u8(dg, vdupq_n_u8(10)), vaddq_u8(dg, vdupq_n_u8(52)), v);
+    v = vbslq_u8(vceqq_u8(c, vdupq_n_u8('+')), vdupq_n_u8(62), v);
+    v = vbslq_u8(vceqq_u8(c, vdupq_n_u8('/')), vdupq_n_u8(63), v);
+    return v;
+}
+
+/* jet_b64_vec - Decode 64-character blocks, stopping before the first bad one
+ *
+ * vld4q de-interleaves quads into four lanes of 6-bit values, vst3q
+ * re-interleaves the three output bytes.
+ *
+ * RETURNS:
+ *   Characters consumed (whole quads); the scalar loop does the rest
+ */
+static size_t jet_b64_vec(const char *s, size_t len, uint8_t *out) {
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        uint8x16x4_t c = vld4q_u8((const uint8_t *)(s + i));
+        uint8x16_t a = jet_b64_nib(c.val[0]);
+        uint8x16_t b = jet_b64_nib(c.val[1]);
+        uint8x16_t d = jet_b64_nib(c.val[2]);
+        uint8x16_t e = jet_b64_nib(c.val[3]);
+        if (vmaxvq_u8(vorrq_u8(vorrq_u8(a, b), vorrq_u8(d, e))) > 63) break;
+
+        uint8x16x3_t o;
+        o.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        o.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(d, 2));
+        o.val[2] = vorrq_u8(vshlq_n_u8(d, 6), e);
+        vst3q_u8(out + i / 4 * 3, o);
+    }
+    return i;
+}
+#endif
+
+/* jet_b64 - Extract and decode a base64 string value
+ *
+ * Decodes {"key":"3q2+7w=="} straight into out, no intermediate copy.
+ * Standard alphabet; '=' padding optional. Table-free (no 256-byte
+ * lookup in flash): a 6-bit accumulator per character, flushing 3 bytes
+ * every 4 characters. Unused low bits of a short tail must be zero.
+ * Built with SSSE3 or AArch64 NEON, a vector kernel decodes whole
+ * 16/64-character blocks first and leaves any bad block to this loop.
+ *
+ * IN PLACE:
+ *   Same rules as jet_hex(): out may point at or before the value in
+ *   the same writable buffer.
+ *
+ * PARAMS / RETURNS:
+ *   As jet_hex(); JET_BAD_ENCODING for characters outside the alphabet,
+ *   misplaced padding, non-zero tail bits or an impossible length
+ */
+jet_err jet_b64(const char *j, const char *needle, uint8_t *out, size_t omax, size_t *olen) {
+    const char *s, *e;
+    jet_err err = jet_find_str(j, needle, &s, &e);
+    if (err != JET_OK) return err;
+
+    size_t len = (size_t)(e - s);
+    size_t pad = 0;
+    while (pad < 2 && len > pad && s[len - 1 - pad] == '=') pad++;
+    if (pad && (len & 3)) return JET_BAD_ENCODING;  // Padded input is whole quads
+    len -= pad;
+    if ((len & 3) == 1) return JET_BAD_ENCODING;
+
+    size_t need = len / 4 * 3 + ((len & 3) ? (len & 3) - 1 : 0);
+    if (need > omax) return JET_TRUNCATED;
+
+    size_t n = 0;
+    size_t i = 0;
+#if defined(JET_BLOB_SSSE3) || defined(JET_BLOB_NEON)
+    i = jet_b64_vec(s, len, out);
+    n = i / 4 * 3;
+#endif
+    uint32_t acc = 0;
+    for (; i < len; i++) {
+        int d = jet_b64_val(s[i]);
+        if (d < 0) return JET_BAD_ENCODING;
+        acc = acc << 6 | (uint32_t)d;
+        if ((i & 3) == 3) {
+            out[n++] = (uint8_t)(acc >> 16);
+            out[n++] = (uint8_t)(acc >> 8);
+            out[n++] = (uint8_t)acc;
+            acc = 0;
+        }
+    }
+
+    if ((len & 3) == 2) {
+        if (acc & 0xF) return JET_BAD_ENCODING;  // Non-canonical tail
+        out[n++] = (uint8_t)(acc >> 4);
+    } else if ((len & 3) == 3) {
+        if (acc & 0x3) return JET_BAD_ENCODING;  // Non-canonical tail
+        out[n++] = (uint8_t)(acc >> 10);
+        out[n++] = (uint8_t)(acc >> 2);
+    }
+
+    *olen = n;
+    return JET_OK;
+}
+
+#endif // PACKET_ATOMS_BLOB
+
+#ifdef PACKET_ATOMS_FRAMING
+
+/* jet_framer - Record framing state
+ *
+ * Splits a receive buffer holding back-to-back messages ("{...}{...}" or
+ * NDJSON) into records. Caller-owned, no malloc. Keeps the scan state of a
+ * record that straddles two reads so its prefix is not rescanned.
+ */
+typedef struct {
+    size_t   scanned;  // Bytes of the pending record already scanned
+    size_t   max_len;  // Longest accepted record, 0 = no limit
+    uint16_t depth;    // Brace depth (brace mode only)
+    uint8_t  in_str;   // Inside a string literal
+    uint8_t  esc;      // Previous string byte was a backslash
+    uint8_t  resync;   // Dropping the rest of an oversized line
+    char     delim;    // 0 = brace framing, otherwise record terminator
+} jet_framer;
+
+/* jet_frame_init - Reset framer
+ *
+ * PARAMS:
+ *   f       - Framer state
+ *   delim   - 0 for concatenated objects ("{...}{...}"), brace depth aware
+ *             of strings; or a terminator byte such as '\n' for NDJSON
+ *   max_len - Longest record accepted, e.g. your receive buffer size.
+ *             Bounds buffering and lets the framer recover from line
+ *             noise (stray '"' or '{'). 0 disables the limit.
+ */
+void jet_frame_init(jet_framer *f, char delim, size_t max_len) {
+    memset(f, 0, sizeof(*f));
+    f->delim = delim;
+    f->max_len = max_len;
+}
+
+/* jet_frame - Find the next record in a receive buffer
+ *
+ * Bytes between records (whitespace, empty lines, anything before '{' in
+ * brace mode) are skipped. Records are returned in place: run jet_n() or
+ * jet_tiny_n() on them directly, then continue from *rec + *rec_len.
+ *
+ * Newline mode uses memchr(), which libc vectorizes on most targets.
+ * A trailing '\r' is stripped from newline-framed records.
+ *
+ * RESUMING:
+ *   On JET_TRUNCATED, *rec and *rec_len hold the incomplete record. Move those
+ *   bytes to the start of your buffer, append the next read after them and
+ *   call again; scanning resumes where it stopped.
+ *
+ * PARAMS:
+ *   f       - Framer state (see jet_frame_init)
+ *   buf     - Receive buffer (not necessarily NUL-terminated)
+ *   len     - Bytes in buffer
+ *   rec     - Output: start of record
+ *   rec_len - Output: record length
+ *
+ * RETURNS:
+ *   JET_OK        - Complete record found
+ *   JET_TRUNCATED - No complete record yet (*rec_len may be 0)
+ *   JET_MALFORMED - Record longer than max_len. *rec and *rec_len are the
+ *                   bytes to drop; continue after them. Brace mode drops
+ *                   the opening '{' and resyncs at the next one, newline
+ *                   mode drops the rest of the line.
+ */
+jet_err jet_frame(jet_framer *f, const char *buf, size_t len, const char **rec, size_t *rec_len) {
+    const char *end = buf + len;
+    const char *s = buf;
+
+    if (f->resync) {  // Finish dropping an oversized line
+        const char *q = (const char *)memchr(s, f->delim, len);
+        if (!q) {
+            *rec = end;
+            *rec_len = 0;
+            return JET_TRUNCATED;
+        }
+        f->resync = 0;
+        s = q + 1;
+    }
+
+    if (f->scanned == 0) {  // Skip bytes between records
+        if (f->delim) {
+            while (s < end && (*s == f->delim || (unsigned char)*s <= ' ')) s++;
+        } else {
+            s = (const char *)memchr(s, '{', (size_t)(end - s));
+            if (!s) s = end;
+        }
+    }
+
+    const char *p = s + f->scanned;
+    const char *lim = end;  // Scan no further than max_len (+ terminator)
+    if (f->max_len && (size_t)(end - s) > f->max_len) {
+        lim = s + f->max_len + (f->delim ? 1 : 0);
+    }
+
+    if (f->delim) {
+        const char *q = (const char *)memchr(p, f->delim, (size_t)(lim - p));
+        if (!q) {
+            *rec = s;
+            *rec_len = (size_t)(lim - s);
+            if (f->max_len && *rec_len > f->max_len) {
+                f->scanned = 0;
+                f->resync = 1;
+                return JET_MALFORMED;
+            }
+            f->scanned = *rec_len;
+            return JET_TRUNCATED;
+        }
+        f->scanned = 0;
+        if (q > s && q[-1] == '\r') q--;
+        *rec = s;
+        *rec_len = (size_t)(q - s);
+        return JET_OK;
+    }
+
+    for (; p < lim; p++) {
+        char c = *p;
+        if (f->in_str) {
+            if (f->esc) f->esc = 0;
+            else if (c == '\\') f->esc = 1;
+            else if (c == '"') f->in_str = 0;
+        } else if (c == '"') {
+            f->in_str = 1;
+        } else if (c == '{') {
+            f->depth++;
+        } else if (c == '}' && --f->depth == 0) {
+            f->scanned = 0;
+            *rec = s;
+            *rec_len = (size_t)(p + 1 - s);
+            return JET_OK;
+        }
+    }
+
+    *rec = s;
+    if (f->max_len && (size_t)(p - s) >= f->max_len) {
+        f->scanned = 0;  // Oversized or corrupt: drop '{', resync
+        f->depth = 0;
+        f->in_str = 0;
+        f->esc = 0;
+        *rec_len = 1;
+        return JET_MALFORMED;
+    }
+
+    f->scanned = (size_t)(end - s);
+    *rec_len = (size_t)(end - s);
+    return JET_TRUNCATED;
+}
+
+#endif // PACKET_ATOMS_FRAMING
+
+#ifdef PACKET_ATOMS_FOREACH
+
+/* jet_type - Value type reported by jet_foreach() */
+typedef enum {
+    JET_TYPE_NULL = 0,
+    JET_TYPE_BOOL,
+    JET_TYPE_NUMBER,
+    JET_TYPE_STRING,
+    JET_TYPE_OBJECT,
+    JET_TYPE_ARRAY
+} jet_type;
+
+/* jet_cb - jet_foreach() callback
+ *
+ * PARAMS:
+ *   key, klen - Key without quotes (escapes left as-is)
+ *   val, vlen - Value: string contents without quotes, or the full
+ *               "{...}" / "[...]" for objects and arrays
+ *   type      - Value type
+ *   depth     - 0 for top-level members, +1 per enclosing object/array
+ *   ctx       - User pointer passed to jet_foreach()
+ *
+ * RETURNS:
+ *   0 to continue, non-zero to stop the scan
+ */
+typedef int (*jet_cb)(const char *key, size_t klen, const char *val, size_t vlen,
+                      jet_type type, uint8_t depth, void *ctx);
+
+/* jet_skip_ws - Skip JSON whitespace, returns first other byte or end */
+static const char* jet_skip_ws(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    return p;
+}
+
+/* jet_is_number - Check JSON number grammar
+ *
+ * -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ *
+ * RETURNS:
+ *   1 if v[0..vlen) is a complete number, else 0
+ */
+static int jet_is_number(const char *v, size_t vlen) {
+    const char *end = v + vlen;
+    const char *p = v;
+
+    if (p < end && *p == '-') p++;
+    if (p >= end || *p < '0' || *p > '9') return 0;
+    if (*p++ == '0') {
+        if (p < end && *p >= '0' && *p <= '9') return 0;  // Leading zero
+    } else {
+        while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+
+    if (p < end && *p == '.') {
+        if (++p >= end || *p < '0' || *p > '9') return 0;
+        while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        if (p < end && (*p == '+' || *p == '-')) p++;
+        if (p >= end || *p < '0' || *p > '9') return 0;
+        while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+
+    return p == end;
+}
+
+/* jet_foreach - Walk every key/value pair
+ *
+ * Calls cb for each member of the top-level object and of every nested
+ * object (including objects inside arrays). Array elements have no key
+ * and are not reported themselves. Works in place on a record, e.g. one
+ * returned by jet_frame(); bytes after the top-level object are ignored.
+ *
+ * No malloc, no recursion: nesting is tracked in a 32-bit stack, so
+ * documents nested deeper than 32 levels are rejected. Object and array
+ * values are skipped once to find their end before the callback, then
+ * walked into, so a byte at depth d is read d + 1 times: O(n * depth),
+ * a single pass for flat documents.
+ *
+ * PARAMS:
+ *   j    - JSON object (not necessarily NUL-terminated)
+ *   jlen - Length in bytes
+ *   cb   - Callback, return non-zero to stop early
+ *   ctx  - User pointer passed to cb
+ *
+ * RETURNS:
+ *   JET_OK        - Walk finished or stopped by cb
+ *   JET_MALFORMED - Syntax error or nesting deeper than 32
+ *   JET_TRUNCATED - Input ended inside the document
+ *
+ *   Pairs are reported as they are reached, before the rest of the
+ *   document is checked: on an error, cb may already have run for
+ *   earlier pairs. Buffer side effects until JET_OK if that matters.
+ *
+ * EXAMPLE:
+ *   int on_pair(const char *k, size_t kl, const char *v, size_t vl,
+ *               jet_type t, uint8_t depth, void *ctx) {
+ *       printf("%.*s = %.*s\n", (int)kl, k, (int)vl, v);
+ *       return 0;
+ *   }
+ *   jet_foreach(json, strlen(json), on_pair, NULL);
+ */
+jet_err jet_foreach(const char *j, size_t jlen, jet_cb cb, void *ctx) {
+    const char *end = j + jlen;
+    const char *p = jet_skip_ws(j, end);
+    uint32_t arrays = 0;  // Bit d set: container at depth d is an array
+    uint8_t level = 0;
+    uint8_t state = 0;    // 0 = container start, 1 = after ',', 2 = after value
+
+    if (p >= end) return JET_TRUNCATED;
+    if (*p++ != '{') return JET_MALFORMED;
+
+    for (;;) {
+        p = jet_skip_ws(p, end);
+        if (p >= end) return JET_TRUNCATED;
+
+        uint8_t in_array = (arrays >> level) & 1;
+
+        if (*p == (in_array ? ']' : '}')) {
+            if (state == 1) return JET_MALFORMED;  // Trailing comma
+            if (level == 0) return JET_OK;
+            arrays &= ~((uint32_t)1 << level);
+            level--;
+            p++;
+            state = 2;
+            continue;
+        }
+        if (state == 2) {
+            if (*p != ',') return JET_MALFORMED;
+            p++;
+            state = 1;
+            continue;
+        }
+
+        const char *key = NULL;
+        size_t klen = 0;
+        if (!in_array) {
+            if (*p != '"') return JET_MALFORMED;
+            key = p + 1;
+            p = jet_skip_str(p, end);
+            if (!p) return JET_TRUNCATED;
+            klen = (size_t)(p - 1 - key);
+            p = jet_skip_ws(p, end);
+            if (p >= end) return JET_TRUNCATED;
+            if (*p++ != ':') return JET_MALFORMED;
+            p = jet_skip_ws(p, end);
+            if (p >= end) return JET_TRUNCATED;
+        }
+
+        const char *v = p;
+        const char *q;
+        size_t vlen;
+        jet_type type;
+
+        if (*p == '"') {
+            q = jet_skip_str(p, end);
+            if (!q) return JET_TRUNCATED;
+            v = p + 1;
+            vlen = (size_t)(q - 1 - v);
+            type = JET_TYPE_STRING;
+        } else if (*p == '{' || *p == '[') {
+            q = jet_skip_nested(p, end);
+            if (!q) return JET_TRUNCATED;
+            vlen = (size_t)(q - v);
+            type = (*p == '{') ? JET_TYPE_OBJECT : JET_TYPE_ARRAY;
+        } else {
+            q = p;
+            while (q < end && *q != ',' && *q != '}' && *q != ']' &&
+                   *q != ' ' && *q != '\t' && *q != '\r' && *q != '\n') q++;
+            vlen = (size_t)(q - v);
+            if (vlen == 0) return JET_MALFORMED;
+            if (vlen == 4 && memcmp(v, "true", 4) == 0) type = JET_TYPE_BOOL;
+            else if (vlen == 5 && memcmp(v, "false", 5) == 0) type = JET_TYPE_BOOL;
+            else if (vlen == 4 && memcmp(v, "null", 4) == 0) type = JET_TYPE_NULL;
+            else if (jet_is_number(v, vlen)) type = JET_TYPE_NUMBER;
+            else return JET_MALFORMED;
+        }
+
+        uint8_t nested = (type == JET_TYPE_OBJECT || type == JET_TYPE_ARRAY);
+        if (nested && level == 31) return JET_MALFORMED;  // Nesting too deep
+
+        if (key && cb(key, klen, v, vlen, type, level, ctx)) return JET_OK;
+
+        if (nested) {
+            level++;
+            if (type == JET_TYPE_ARRAY) arrays |= (uint32_t)1 << level;
+            p++;
+            state = 0;
+            continue;
+        }
+
+        p = q;
+        state = 2;
+    }
+}
+
+#endif // PACKET_ATOMS_FOREACH
+
 #endif // PACKET_ATOMS_H
@@ -0,0 +1,121 @@
+// packet_atoms.hpp - MIT License - CoreLathe.com
+// C++17 extractor with packet_atoms.h semantics: string_view in, slices out
+// Version: 1.0.0
+//
+// No exceptions, no heap. Builds with -fno-exceptions -fno-rtti.
+// Header-only and safe to include from any number of translation units.
+// It does not pull in packet_atoms.h (whose functions are not inline);
+// include that in one translation unit if you also need the C API.
+
+#ifndef PACKET_ATOMS_HPP
+#define PACKET_ATOMS_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace packet_atoms {
+
+/* key - Compile-time needle
+ *
+ * Builds the "\"key\":" search pattern at compile time, replacing the
+ * run-time snprintf() in jet(). No key length limit.
+ *
+ * EXAMPLE:
+ *   constexpr packet_atoms::key temp("temp");  // temp.view() == "\"temp\":"
+ */
+template <std::size_t N>
+struct key {
+    char needle[N + 2];  // Quote + key + quote + colon, no NUL
+
+    constexpr key(const char (&k)[N]) : needle{} {
+        needle[0] = '"';
+        for (std::size_t i = 0; i + 1 < N; i++) needle[i + 1] = k[i];
+        needle[N] = '"';
+        needle[N + 1] = ':';
+    }
+
+    constexpr std::string_view view() const noexcept {
+        return std::string_view(needle, N + 2);
+    }
+};
+
+/* find - Core field extractor
+ *
+ * Same rules as jet_tiny(): first match of needle, optional spaces
+ * skipped, value ends at ',' or '}' or end of input.
+ *
+ * PARAMS:
+ *   j      - JSON text (not necessarily NUL-terminated)
+ *   needle - Search pattern (e.g., "\"temp\":")
+ *
+ * RETURNS:
+ *   Slice of j holding the raw value, or std::nullopt if the key is
+ *   missing or the value is empty
+ */
+constexpr std::optional<std::string_view> find(std::string_view j, std::string_view needle) noexcept {
+    if (needle.empty()) return std::nullopt;
+
+    std::size_t pos = j.find(needle);
+    if (pos == std::string_view::npos) return std::nullopt;
+
+    pos += needle.size();
+    while (pos < j.size() && j[pos] == ' ') pos++;  // Skip optional spaces
+
+    std::size_t end = j.find_first_of(",}", pos);
+    if (end == std::string_view::npos) end = j.size();
+    if (end == pos) return std::nullopt;
+
+    return j.substr(pos, end - pos);
+}
+
+/* jet - Extract raw value slice by compile-time key
+ *
+ * EXAMPLE:
+ *   constexpr packet_atoms::key temp("temp");
+ *   auto v = packet_atoms::jet(msg, temp);  // v == "22.5"
+ */
+template <std::size_t N>
+constexpr std::optional<std::string_view> jet(std::string_view j, const key<N> &k) noexcept {
+    return find(j, k.view());
+}
+
+/* get - Extract and convert a value
+ *
+ * Integers and floating point use std::from_chars (no locale, no
+ * allocation). bool accepts "true"/"false" and "1"/"0". The whole slice
+ * must convert, so "22.5" as int is rejected.
+ *
+ * RETURNS:
+ *   Converted value, or std::nullopt on missing key or bad value
+ *
+ * EXAMPLE:
+ *   auto t = packet_atoms::get<double>(msg, packet_atoms::key("temp"));
+ */
+template <class T, std::size_t N>
+std::optional<T> get(std::string_view j, const key<N> &k) noexcept {
+    static_assert(std::is_arithmetic_v<T>, "get<T> supports arithmetic types only");
+
+    std::optional<std::string_view> v = jet(j, k);
+    if (!v) return std::nullopt;
+
+    if constexpr (std::is_same_v<T, bool>) {
+        if (*v == "true" || *v == "1") return true;
+        if (*v == "false" || *v == "0") return false;
+        return std::nullopt;
+    } else {
+        const char *first = v->data();
+        const char *last = first + v->size();
+        T out{};
+        std::from_chars_result r = std::from_chars(first, last, out);
+        if (r.ec != std::errc() || r.ptr != last) return std::nullopt;
+        return out;
+    }
+}
+
+}  // namespace packet_atoms
+
+#endif // PACKET_ATOMS_HPP
@@ -0,0 +1,86 @@
+# stack_report.awk - Worst-case stack per call chain for make stack
+# Input 1: "name size" lines from nm (code size per function)
+# Input 2: GCC call graph from -fcallgraph-info=su (.ci, VCG format)
+#
+# Output per library function: own frame, worst call chain (own frame plus
+# deepest callee chain) and callees with no stack info (libc, not counted).
+# A function on or above a recursive cycle has no bound: it is reported as
+# "unbounded (recursive)" and the script exits with status 1.
+
+NR == FNR { code[$1] = $2; next }
+
+# Static functions are titled "file:name"
+function base(name) {
+    sub(/^.*:/, "", name)
+    return name
+}
+
+/^node:/ {
+    split($0, q, "\"")
+    name = base(q[2])
+    if (match(q[4], /[0-9]+ bytes \([^)]*\)/)) {
+        s = substr(q[4], RSTART, RLENGTH)
+        own[name] = s + 0
+        kind[name] = substr(s, index(s, "(") + 1)
+        sub(/\)$/, "", kind[name])
+        local[name] = 1
+    }
+    next
+}
+
+/^edge:/ {
+    split($0, q, "\"")
+    q[2] = base(q[2])
+    q[4] = base(q[4])
+    if (!((q[2] SUBSEP q[4]) in seen_edge)) {
+        seen_edge[q[2], q[4]] = 1
+        ncallee[q[2]]++
+        callee[q[2], ncallee[q[2]]] = q[4]
+    }
+    next
+}
+
+# Returns chain bytes, or -1 if unbounded (recursion)
+function chain(f,    i, c, t, best) {
+    if (f in total) return total[f]
+    if (!(f in local)) return 0
+    if (visiting[f]) return -1
+    visiting[f] = 1
+    best = 0
+    for (i = 1; i <= ncallee[f]; i++) {
+        c = callee[f, i]
+        t = chain(c)
+        if (t < 0) best = -1
+        else if (best >= 0 && t > best) best = t
+        if (c == "__indirect_call") add_ext(f, "callback")
+        else if (!(c in local)) add_ext(f, c)
+        else if (ext[c] != "") add_ext(f, ext[c])
+    }
+    visiting[f] = 0
+    total[f] = (best < 0) ? -1 : own[f] + best
+    return total[f]
+}
+
+function add_ext(f, names,    n, a, i) {
+    n = split(names, a, ",")
+    for (i = 1; i <= n; i++) {
+        if (index("," ext[f] ",", "," a[i] ",")) continue
+        ext[f] = (ext[f] == "") ? a[i] : ext[f] "," a[i]
+    }
+}
+
+END {
+    for (f in local) {
+        if (f ~ /^test_/) continue
+        if (chain(f) < 0) {
+            unbounded = 1
+            bound = "chain unbounded (recursive)"
+        } else {
+            bound = sprintf("chain %4d bytes (%s)", total[f], kind[f])
+        }
+        printf "  %-16s own %4d  %s  code %5d bytes%s\n", \
+               f, own[f], bound, code[f], \
+               (ext[f] == "") ? "" : "  + " ext[f]
+    }
+    exit unbounded
+}
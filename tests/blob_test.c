@@ -0,0 +1,186 @@
+// blob_test.c - Hex and base64 decoding of extracted blob fields
+// Compile: gcc -Wall -Wextra -Werror -std=c99 -o blob_test blob_test.c
+// Run: ./blob_test
+// SIMD: add -mssse3 (x86) to cover the vector kernels; AArch64 uses NEON
+
+#define PACKET_ATOMS_BLOB
+#include "packet_atoms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+typedef jet_err (*decoder)(const char *, const char *, uint8_t *, size_t, size_t *);
+
+// Test helpers
+void assert_decode(decoder dec, const char *json, const char *expected, size_t expected_len) {
+    uint8_t buf[64];
+    size_t len = 0;
+    jet_err err = dec(json, "\"d\":", buf, sizeof(buf), &len);
+    if (err != JET_OK) {
+        printf("    JSON: %s\n    Got error %d\n", json, err);
+        FAIL("Expected JET_OK");
+    }
+    if (len != expected_len || memcmp(buf, expected, len) != 0) {
+        printf("    JSON: %s\n    Expected %u bytes, Got %u\n", json, (unsigned)expected_len, (unsigned)len);
+        FAIL("Decoded bytes mismatch");
+    }
+}
+
+void assert_decode_err(decoder dec, const char *json, size_t omax, jet_err expected_err) {
+    uint8_t buf[64];
+    size_t len = 0;
+    jet_err err = dec(json, "\"d\":", buf, omax, &len);
+    if (err != expected_err) {
+        printf("    JSON: %s\n    Expected error %d, Got %d\n", json, expected_err, err);
+        FAIL("Error code mismatch");
+    }
+}
+
+// Test cases
+void test_hex() {
+    TEST("Hex decoding");
+    assert_decode(jet_hex, "{\"d\":\"deadBEEF\"}", "\xde\xad\xbe\xef", 4);
+    assert_decode(jet_hex, "{\"n\":1,\"d\": \"00ff10\"}", "\x00\xff\x10", 3);
+    assert_decode(jet_hex, "{\"d\":\"\"}", "", 0);
+    PASS();
+}
+
+void test_base64() {
+    TEST("Base64 decoding");
+    assert_decode(jet_b64, "{\"d\":\"3q2+7w==\"}", "\xde\xad\xbe\xef", 4);
+    assert_decode(jet_b64, "{\"d\":\"3q2+7w\"}", "\xde\xad\xbe\xef", 4);
+    assert_decode(jet_b64, "{\"d\":\"TWFu\"}", "Man", 3);
+    assert_decode(jet_b64, "{\"d\":\"TWE=\"}", "Ma", 2);
+    assert_decode(jet_b64, "{\"d\":\"TQ==\"}", "M", 1);
+    assert_decode(jet_b64, "{\"d\":\"/+/+\"}", "\xff\xef\xfe", 3);
+    assert_decode(jet_b64, "{\"d\":\"\"}", "", 0);
+    PASS();
+}
+
+void test_bad_encoding() {
+    TEST("Invalid input rejected");
+    assert_decode_err(jet_hex, "{\"d\":\"abc\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_hex, "{\"d\":\"zz\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_hex, "{\"d\":\"0g\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"TQ=A\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"TWFuT\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"TW=\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"T!Fu\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"QR==\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"TWF=\"}", 64, JET_BAD_ENCODING);
+    assert_decode_err(jet_b64, "{\"d\":\"TWF\"}", 64, JET_BAD_ENCODING);
+    PASS();
+}
+
+void test_other_errors() {
+    TEST("Missing, malformed and truncated");
+    assert_decode_err(jet_hex, "{\"x\":\"00\"}", 64, JET_KEY_MISSING);
+    assert_decode_err(jet_hex, "{\"d\":00}", 64, JET_MALFORMED);
+    assert_decode_err(jet_b64, "{\"d\":\"TWFu", 64, JET_MALFORMED);
+    assert_decode_err(jet_hex, "{\"d\":\"010203\"}", 2, JET_TRUNCATED);
+    assert_decode_err(jet_b64, "{\"d\":\"TWFu\"}", 2, JET_TRUNCATED);
+    PASS();
+}
+
+void test_in_place() {
+    TEST("Decode in place over source buffer");
+    char json[] = "{\"chunk\":\"SGVsbG8sIE9UQSE=\"}";
+    size_t len = 0;
+    if (jet_b64(json, "\"chunk\":", (uint8_t *)json, sizeof(json), &len) != JET_OK) FAIL("b64 in place");
+    if (len != 11 || memcmp(json, "Hello, OTA!", len) != 0) FAIL("b64 in place bytes");
+
+    char hex[] = "{\"fw\":\"48656c6c6f\"}";
+    if (jet_hex(hex, "\"fw\":", (uint8_t *)hex, sizeof(hex), &len) != JET_OK) FAIL("hex in place");
+    if (len != 5 || memcmp(hex, "Hello", len) != 0) FAIL("hex in place bytes");
+    PASS();
+}
+
+// Long payloads cross the vector block sizes (16/32/64) with scalar tails
+void test_long_payload() {
+    TEST("Long payloads match byte-by-byte reference");
+    static const char alpha[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const char hexd[] = "0123456789abcdef";
+    static char json[1200];
+    static uint8_t ref[300];
+    static uint8_t out[300];
+    unsigned seed = 12345;
+
+    for (size_t n = 0; n <= sizeof(ref); n += 7) {
+        for (size_t k = 0; k < n; k++) {
+            seed = seed * 1103515245u + 12345u;
+            ref[k] = (uint8_t)(seed >> 16);
+        }
+
+        // Hex, mixed case
+        size_t p = (size_t)sprintf(json, "{\"d\":\"");
+        for (size_t k = 0; k < n; k++) {
+            char hi = hexd[ref[k] >> 4];
+            json[p++] = (char)(k & 1 && hi >= 'a' ? hi - 'a' + 'A' : hi);
+            json[p++] = hexd[ref[k] & 15];
+        }
+        strcpy(json + p, "\"}");
+        size_t len = 0;
+        if (jet_hex(json, "\"d\":", out, sizeof(out), &len) != JET_OK) FAIL("long hex");
+        if (len != n || memcmp(out, ref, n) != 0) FAIL("long hex bytes");
+
+        // Base64, padded, decoded in place
+        p = (size_t)sprintf(json, "{\"d\":\"");
+        for (size_t k = 0; k < n; k += 3) {
+            uint32_t acc = (uint32_t)ref[k] << 16;
+            if (k + 1 < n) acc |= (uint32_t)ref[k + 1] << 8;
+            if (k + 2 < n) acc |= ref[k + 2];
+            json[p++] = alpha[acc >> 18 & 63];
+            json[p++] = alpha[acc >> 12 & 63];
+            json[p++] = k + 1 < n ? alpha[acc >> 6 & 63] : '=';
+            json[p++] = k + 2 < n ? alpha[acc & 63] : '=';
+        }
+        strcpy(json + p, "\"}");
+        if (jet_b64(json, "\"d\":", (uint8_t *)json, sizeof(json), &len) != JET_OK) FAIL("long b64");
+        if (len != n || memcmp(json, ref, n) != 0) FAIL("long b64 bytes");
+    }
+    PASS();
+}
+
+// A bad character anywhere in a long payload, including inside a vector block
+void test_long_bad_char() {
+    TEST("Bad character found at every position");
+    static char json[200];
+    uint8_t out[100];
+    size_t len = 0;
+
+    for (size_t at = 0; at < 128; at++) {
+        sprintf(json, "{\"d\":\"");
+        memset(json + 6, 'A', 128);
+        strcpy(json + 6 + 128, "\"}");
+
+        json[6 + at] = '@';
+        if (jet_hex(json, "\"d\":", out, sizeof(out), &len) != JET_BAD_ENCODING) FAIL("hex '@'");
+        json[6 + at] = '\x80';
+        if (jet_b64(json, "\"d\":", out, sizeof(out), &len) != JET_BAD_ENCODING) FAIL("b64 0x80");
+        json[6 + at] = ':';
+        if (jet_b64(json, "\"d\":", out, sizeof(out), &len) != JET_BAD_ENCODING) FAIL("b64 ':'");
+        json[6 + at] = 'A';
+        if (jet_b64(json, "\"d\":", out, sizeof(out), &len) != JET_OK || len != 96) FAIL("b64 clean");
+    }
+    PASS();
+}
+
+int main(void) {
+    printf("=== Packet Atoms Blob Decoding Tests ===\n\n");
+
+    test_hex();
+    test_base64();
+    test_bad_encoding();
+    test_other_errors();
+    test_in_place();
+    test_long_payload();
+    test_long_bad_char();
+
+    printf("\n=== ALL BLOB DECODING TESTS PASSED ===\n");
+    return 0;
+}
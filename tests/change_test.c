@@ -0,0 +1,122 @@
+// change_test.c - Change detection against the previous message
+// Compile: gcc -Wall -Wextra -Werror -std=c99 -o change_test change_test.c
+// Run: ./change_test
+
+#define PACKET_ATOMS_CHANGED
+#include "packet_atoms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+static const char *const fields[] = { "\"temp\":", "\"hum\":", "\"pres\":" };
+
+// Test helpers
+void assert_changed(jet_fp *fp, const char *json, uint32_t expected) {
+    uint32_t got = jet_changed(fp, json, strlen(json), fields, 3);
+    if (got != expected) {
+        printf("    JSON: %s\n    Expected mask: 0x%x, Got: 0x%x\n",
+               json, (unsigned)expected, (unsigned)got);
+        FAIL("Changed mask mismatch");
+    }
+}
+
+// Test cases
+void test_first_message() {
+    TEST("First message reports all present fields");
+    jet_fp fp = {0};
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":65}", 0x3);
+    PASS();
+}
+
+void test_repeated_message() {
+    TEST("Repeated message reports nothing");
+    jet_fp fp = {0};
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":65,\"pres\":1013}", 0x7);
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":65,\"pres\":1013}", 0x0);
+    assert_changed(&fp, "{\"temp\": 22.5,\"hum\":65,\"pres\":1013}", 0x0);
+    PASS();
+}
+
+void test_single_field_change() {
+    TEST("Single field change");
+    jet_fp fp = {0};
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":65,\"pres\":1013}", 0x7);
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":66,\"pres\":1013}", 0x2);
+    assert_changed(&fp, "{\"temp\":22.50,\"hum\":66,\"pres\":1013}", 0x1);
+    PASS();
+}
+
+void test_presence_change() {
+    TEST("Field appearing or disappearing");
+    jet_fp fp = {0};
+    assert_changed(&fp, "{\"temp\":22.5,\"hum\":65}", 0x3);
+    assert_changed(&fp, "{\"temp\":22.5}", 0x2);
+    assert_changed(&fp, "{\"temp\":22.5}", 0x0);
+    assert_changed(&fp, "{\"temp\":22.5,\"pres\":1013}", 0x4);
+    PASS();
+}
+
+void test_out_of_order() {
+    TEST("Out-of-order fields still found");
+    jet_fp fp = {0};
+    assert_changed(&fp, "{\"temp\":1,\"hum\":2,\"pres\":3}", 0x7);
+    assert_changed(&fp, "{\"pres\":3,\"hum\":2,\"temp\":1}", 0x0);
+    PASS();
+}
+
+void test_duplicate_key() {
+    TEST("First occurrence wins over later duplicate");
+    static const char *const xt[] = { "\"x\":", "\"temp\":" };
+    const char *m1 = "{\"temp\":1,\"x\":5,\"n\":{\"temp\":2}}";
+    const char *m2 = "{\"temp\":9,\"x\":5,\"n\":{\"temp\":2}}";
+    jet_fp fp = {0};
+    if (jet_changed(&fp, m1, strlen(m1), xt, 2) != 0x3) FAIL("First message");
+    if (jet_changed(&fp, m2, strlen(m2), xt, 2) != 0x2) FAIL("Top-level temp change missed");
+    PASS();
+}
+
+void test_delimiters_inside_values() {
+    TEST("Changes after ',' or '}' inside a value");
+    static const char *const pos[] = { "\"pos\":", "\"s\":" };
+    jet_fp fp = {0};
+    const char *m1 = "{\"pos\":{\"x\":1,\"y\":2},\"s\":\"a,b\"}";
+    const char *m2 = "{\"pos\":{\"x\":1,\"y\":3},\"s\":\"a,b\"}";
+    const char *m3 = "{\"pos\":{\"x\":1,\"y\":3},\"s\":\"a,c\"}";
+    const char *m4 = "{\"pos\":[1,{\"z\":4}],\"s\":\"a,c\"}";
+    const char *m5 = "{\"pos\":[1,{\"z\":5}],\"s\":\"a,c\"}";
+    if (jet_changed(&fp, m1, strlen(m1), pos, 2) != 0x3) FAIL("First message");
+    if (jet_changed(&fp, m2, strlen(m2), pos, 2) != 0x1) FAIL("Nested object change missed");
+    if (jet_changed(&fp, m3, strlen(m3), pos, 2) != 0x2) FAIL("String change after ',' missed");
+    if (jet_changed(&fp, m4, strlen(m4), pos, 2) != 0x1) FAIL("Array value");
+    if (jet_changed(&fp, m5, strlen(m5), pos, 2) != 0x1) FAIL("Nested array change missed");
+    if (jet_changed(&fp, m5, strlen(m5), pos, 2) != 0x0) FAIL("Repeat must be unchanged");
+    PASS();
+}
+
+void test_bounded_record() {
+    TEST("Scan stays inside record");
+    jet_fp fp = {0};
+    const char *stream = "{\"temp\":1}{\"hum\":2}";
+    if (jet_changed(&fp, stream, 10, fields, 3) != 0x1) FAIL("Read past record end");
+    PASS();
+}
+
+int main(void) {
+    printf("=== Packet Atoms Change Detection Tests ===\n\n");
+
+    test_first_message();
+    test_repeated_message();
+    test_single_field_change();
+    test_presence_change();
+    test_out_of_order();
+    test_duplicate_key();
+    test_delimiters_inside_values();
+    test_bounded_record();
+
+    printf("\n=== ALL CHANGE DETECTION TESTS PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,51 @@
+// cpp_bench.cpp - C path (jet + atof) vs C++ path (key + get<double>)
+// Compile: g++ -std=c++17 -O2 -fno-exceptions -fno-rtti -o cpp_bench cpp_bench.cpp
+// Run: ./cpp_bench
+
+#include "packet_atoms.h"
+#include "packet_atoms.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace pa = packet_atoms;
+
+static const char *msg =
+    "{\"sensor\":\"BME280\",\"temp\":22.5,\"hum\":65.2,\"pres\":1013.25,\"alt\":120.5}";
+
+static const int ITERATIONS = 2000000;
+
+template <class F>
+static double ns_per_call(F f) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ITERATIONS;
+}
+
+int main() {
+    volatile double sink = 0;
+    const char *volatile input = msg;  // Keep the compiler from folding the scan
+
+    double c_path = ns_per_call([&] {
+        char buf[16];
+        if (jet(input, "pres", buf, sizeof(buf)) == JET_OK) sink = sink + atof(buf);
+    });
+
+    double c_tiny = ns_per_call([&] {
+        char buf[16];
+        if (jet_tiny(input, "\"pres\":", buf, sizeof(buf)) == JET_OK) sink = sink + atof(buf);
+    });
+
+    constexpr pa::key pres("pres");
+    double cpp_path = ns_per_call([&] {
+        if (auto v = pa::get<double>(std::string_view(input), pres)) sink = sink + *v;
+    });
+
+    printf("=== Packet Atoms C vs C++ Benchmark ===\n\n");
+    printf("Extract + convert \"pres\" (%d iterations):\n", ITERATIONS);
+    printf("  jet() + atof()          %7.1f ns/call\n", c_path);
+    printf("  jet_tiny() + atof()     %7.1f ns/call\n", c_tiny);
+    printf("  get<double>(key)        %7.1f ns/call\n", cpp_path);
+    return 0;
+}
@@ -0,0 +1,92 @@
+// cpp_test.cpp - Tests for the C++17 header
+// Compile: g++ -Wall -Wextra -Werror -std=c++17 -fno-exceptions -fno-rtti -o cpp_test cpp_test.cpp cpp_test_unit.cpp
+// Run: ./cpp_test
+
+#include "packet_atoms.h"
+#include "packet_atoms.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+namespace pa = packet_atoms;
+
+// Defined in cpp_test_unit.cpp, a second translation unit using the header
+std::optional<double> unit_temp(std::string_view json);
+
+// Needles are built at compile time
+static_assert(pa::key("temp").view() == "\"temp\":");
+static_assert(*pa::jet(std::string_view("{\"x\":1}"), pa::key("x")) == "1");
+
+// Test cases
+void test_slices() {
+    TEST("String view slices");
+    std::string_view json = "{\"temp\": 22.5,\"hum\":65}";
+    constexpr pa::key temp("temp");
+    constexpr pa::key hum("hum");
+
+    auto t = pa::jet(json, temp);
+    if (!t || *t != "22.5") FAIL("temp slice");
+    if (t->data() != json.data() + 9) FAIL("Slice must point into input");
+    auto h = pa::jet(json, hum);
+    if (!h || *h != "65") FAIL("hum slice");
+    if (pa::jet(json, pa::key("pres"))) FAIL("Missing key must be nullopt");
+    if (pa::jet(std::string_view("{\"x\":}"), pa::key("x"))) FAIL("Empty value must be nullopt");
+    PASS();
+}
+
+void test_not_nul_terminated() {
+    TEST("Input bounded by view size");
+    const char stream[] = "{\"temp\":21}{\"hum\":40}";
+    std::string_view first(stream, 11);
+    if (pa::jet(first, pa::key("hum"))) FAIL("Read past view end");
+    auto v = pa::jet(std::string_view(stream, 9), pa::key("temp"));
+    if (!v || *v != "2") FAIL("Value must stop at view end");
+    PASS();
+}
+
+void test_typed_get() {
+    TEST("Typed get<T>");
+    std::string_view json = "{\"temp\":-22.5,\"count\":42,\"big\":1.2e10,\"on\":true}";
+
+    auto t = pa::get<double>(json, pa::key("temp"));
+    if (!t || *t != -22.5) FAIL("double");
+    auto c = pa::get<int>(json, pa::key("count"));
+    if (!c || *c != 42) FAIL("int");
+    auto u = pa::get<uint8_t>(json, pa::key("count"));
+    if (!u || *u != 42) FAIL("uint8_t");
+    auto b = pa::get<float>(json, pa::key("big"));
+    if (!b || *b != 1.2e10f) FAIL("float scientific");
+    auto on = pa::get<bool>(json, pa::key("on"));
+    if (!on || !*on) FAIL("bool");
+
+    if (pa::get<int>(json, pa::key("temp"))) FAIL("Partial conversion must fail");
+    if (pa::get<uint8_t>(std::string_view("{\"x\":300}"), pa::key("x"))) FAIL("Overflow must fail");
+    if (pa::get<int>(json, pa::key("missing"))) FAIL("Missing key must fail");
+    PASS();
+}
+
+void test_c_api_alongside() {
+    TEST("C API alongside");
+    char buf[16];
+    if (jet("{\"temp\":22.5}", "temp", buf, sizeof(buf)) != JET_OK) FAIL("C jet()");
+    if (strcmp(buf, "22.5") != 0) FAIL("C value");
+    auto t = unit_temp("{\"temp\":22.5}");
+    if (!t || *t != 22.5) FAIL("Second translation unit");
+    PASS();
+}
+
+int main() {
+    printf("=== Packet Atoms C++ Header Tests ===\n\n");
+
+    test_slices();
+    test_not_nul_terminated();
+    test_typed_get();
+    test_c_api_alongside();
+
+    printf("\n=== ALL C++ TESTS PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,8 @@
+// cpp_test_unit.cpp - Second translation unit for cpp_test
+// Links with cpp_test.cpp to check packet_atoms.hpp in more than one file
+
+#include "packet_atoms.hpp"
+
+std::optional<double> unit_temp(std::string_view json) {
+    return packet_atoms::get<double>(json, packet_atoms::key("temp"));
+}
@@ -0,0 +1,163 @@
+// foreach_test.c - Callback walk over all key/value pairs
+// Compile: gcc -Wall -Wextra -Werror -std=c99 -o foreach_test foreach_test.c
+// Run: ./foreach_test
+
+#define PACKET_ATOMS_FOREACH
+#include "packet_atoms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+// Records every pair as "depth:key=value/type;" for easy comparison
+typedef struct {
+    char out[512];
+    size_t len;
+    int stop_after;  // 0 = never stop
+    int calls;
+} recorder;
+
+int record_pair(const char *key, size_t klen, const char *val, size_t vlen,
+                jet_type type, uint8_t depth, void *ctx) {
+    recorder *r = (recorder *)ctx;
+    if (r->len < sizeof(r->out)) {
+        r->len += (size_t)snprintf(r->out + r->len, sizeof(r->out) - r->len, "%u:%.*s=%.*s/%d;",
+                                   (unsigned)depth, (int)klen, key, (int)vlen, val, (int)type);
+    }
+    r->calls++;
+    return r->stop_after && r->calls >= r->stop_after;
+}
+
+// Test helpers
+void assert_walk(const char *json, const char *expected) {
+    recorder r = { {0}, 0, 0, 0 };
+    jet_err err = jet_foreach(json, strlen(json), record_pair, &r);
+    if (err != JET_OK) {
+        printf("    JSON: %s\n    Got error %d\n", json, err);
+        FAIL("Expected JET_OK");
+    }
+    if (strcmp(r.out, expected) != 0) {
+        printf("    Expected: '%s'\n    Got:      '%s'\n", expected, r.out);
+        FAIL("Walk mismatch");
+    }
+}
+
+void assert_walk_err(const char *json, jet_err expected_err) {
+    recorder r = { {0}, 0, 0, 0 };
+    jet_err err = jet_foreach(json, strlen(json), record_pair, &r);
+    if (err != expected_err) {
+        printf("    JSON: %s\n    Expected error %d, Got %d\n", json, expected_err, err);
+        FAIL("Error code mismatch");
+    }
+}
+
+// Test cases
+void test_flat_types() {
+    TEST("Flat object, all value types");
+    assert_walk("{\"t\":22.5,\"s\":\"hot\",\"b\":true,\"f\":false,\"n\":null,\"i\":-3}",
+                "0:t=22.5/2;0:s=hot/3;0:b=true/1;0:f=false/1;0:n=null/0;0:i=-3/2;");
+    assert_walk("{}", "");
+    assert_walk("{\"a\":0,\"b\":-0.5,\"c\":1E+3,\"d\":2e-7}",
+                "0:a=0/2;0:b=-0.5/2;0:c=1E+3/2;0:d=2e-7/2;");
+    PASS();
+}
+
+void test_whitespace() {
+    TEST("Whitespace around tokens");
+    assert_walk(" {\n  \"a\" : 1 ,\r\n  \"b\":\t\"x y\"\n}\n", "0:a=1/2;0:b=x y/3;");
+    PASS();
+}
+
+void test_nesting() {
+    TEST("Nested objects and arrays");
+    assert_walk("{\"state\":{\"reported\":{\"temp\":22}},\"v\":1}",
+                "0:state={\"reported\":{\"temp\":22}}/4;"
+                "1:reported={\"temp\":22}/4;"
+                "2:temp=22/2;"
+                "0:v=1/2;");
+    assert_walk("{\"r\":[1,{\"a\":2},[3]],\"c\":4}",
+                "0:r=[1,{\"a\":2},[3]]/5;2:a=2/2;0:c=4/2;");
+    PASS();
+}
+
+void test_strings_with_syntax() {
+    TEST("Strings containing syntax and escapes");
+    assert_walk("{\"k,}\":\"a\\\"},{\",\"x\":1}", "0:k,}=a\\\"},{/3;0:x=1/2;");
+    PASS();
+}
+
+void test_early_stop() {
+    TEST("Callback stops the scan");
+    const char *json = "{\"a\":1,\"b\":2,\"c\":3}";
+    recorder r = { {0}, 0, 2, 0 };
+    if (jet_foreach(json, strlen(json), record_pair, &r) != JET_OK) FAIL("Expected JET_OK");
+    if (r.calls != 2) FAIL("Scan did not stop");
+    PASS();
+}
+
+void test_errors() {
+    TEST("Malformed and truncated input");
+    assert_walk_err("", JET_TRUNCATED);
+    assert_walk_err("[1,2]", JET_MALFORMED);
+    assert_walk_err("{\"a\":1,}", JET_MALFORMED);
+    assert_walk_err("{\"a\":1 \"b\":2}", JET_MALFORMED);
+    assert_walk_err("{\"a\" 1}", JET_MALFORMED);
+    assert_walk_err("{\"a\":}", JET_MALFORMED);
+    assert_walk_err("{\"a\":x}", JET_MALFORMED);
+    assert_walk_err("{\"a\":-}", JET_MALFORMED);
+    assert_walk_err("{\"a\":1e}", JET_MALFORMED);
+    assert_walk_err("{\"a\":1.}", JET_MALFORMED);
+    assert_walk_err("{\"a\":01}", JET_MALFORMED);
+    assert_walk_err("{\"a\":1x}", JET_MALFORMED);
+    assert_walk_err("{\"a\":[1}", JET_MALFORMED);
+    assert_walk_err("{\"a\":[1,2", JET_TRUNCATED);
+    assert_walk_err("{\"a\":1", JET_TRUNCATED);
+    assert_walk_err("{\"a\":\"abc", JET_TRUNCATED);
+    assert_walk_err("{\"a\":\"ab\\", JET_TRUNCATED);
+    PASS();
+}
+
+void test_depth_limit() {
+    TEST("Nesting limit checked before callback");
+    char json[256];
+    size_t n = 0;
+    for (int i = 0; i < 33; i++) { memcpy(json + n, "{\"k\":", 5); n += 5; }
+    json[n++] = '1';
+    for (int i = 0; i < 33; i++) json[n++] = '}';
+    json[n] = '\0';
+
+    recorder r = { {0}, 0, 0, 0 };
+    if (jet_foreach(json + 5, n - 6, record_pair, &r) != JET_OK) FAIL("32 open objects must pass");
+    r.calls = 0;
+    if (jet_foreach(json, n, record_pair, &r) != JET_MALFORMED) FAIL("33 open objects must fail");
+    if (r.calls != 31) FAIL("Too-deep container reached the callback");
+    PASS();
+}
+
+void test_framed_record() {
+    TEST("Walk a framed record in place");
+    const char *stream = "{\"a\":1}{\"b\":2}";
+    recorder r = { {0}, 0, 0, 0 };
+    if (jet_foreach(stream, 7, record_pair, &r) != JET_OK) FAIL("Expected JET_OK");
+    if (strcmp(r.out, "0:a=1/2;") != 0) FAIL("Walk left the record");
+    PASS();
+}
+
+int main(void) {
+    printf("=== Packet Atoms Foreach Tests ===\n\n");
+
+    test_flat_types();
+    test_whitespace();
+    test_nesting();
+    test_strings_with_syntax();
+    test_early_stop();
+    test_errors();
+    test_depth_limit();
+    test_framed_record();
+
+    printf("\n=== ALL FOREACH TESTS PASSED ===\n");
+    return 0;
+}
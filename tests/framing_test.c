@@ -0,0 +1,197 @@
+// framing_test.c - Record framing for back-to-back JSON streams
+// Compile: gcc -Wall -Wextra -Werror -std=c99 -o framing_test framing_test.c
+// Run: ./framing_test
+
+#define PACKET_ATOMS_FRAMING
+#include "packet_atoms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+// Test helpers
+void assert_record(jet_framer *f, const char **buf, const char *end, const char *expected) {
+    const char *rec;
+    size_t rec_len;
+    if (jet_frame(f, *buf, (size_t)(end - *buf), &rec, &rec_len) != JET_OK) FAIL("Expected JET_OK");
+    if (rec_len != strlen(expected) || memcmp(rec, expected, rec_len) != 0) {
+        printf("    Expected: '%s', Got: '%.*s'\n", expected, (int)rec_len, rec);
+        FAIL("Record mismatch");
+    }
+    *buf = rec + rec_len;
+}
+
+void assert_no_record(jet_framer *f, const char *buf, const char *end) {
+    const char *rec;
+    size_t rec_len;
+    if (jet_frame(f, buf, (size_t)(end - buf), &rec, &rec_len) != JET_TRUNCATED) {
+        FAIL("Expected JET_TRUNCATED");
+    }
+}
+
+// Test cases
+void test_concatenated() {
+    TEST("Concatenated objects");
+    const char *stream = "{\"a\":1}{\"b\":2} {\"c\":3}\r\n";
+    const char *p = stream, *end = stream + strlen(stream);
+    jet_framer f;
+    jet_frame_init(&f, 0, 64);
+
+    assert_record(&f, &p, end, "{\"a\":1}");
+    assert_record(&f, &p, end, "{\"b\":2}");
+    assert_record(&f, &p, end, "{\"c\":3}");
+    assert_no_record(&f, p, end);
+    PASS();
+}
+
+void test_nested_and_strings() {
+    TEST("Braces inside nesting and strings");
+    const char *stream = "{\"s\":{\"r\":{\"t\":1}}}{\"m\":\"}{\\\"}\"}";
+    const char *p = stream, *end = stream + strlen(stream);
+    jet_framer f;
+    jet_frame_init(&f, 0, 64);
+
+    assert_record(&f, &p, end, "{\"s\":{\"r\":{\"t\":1}}}");
+    assert_record(&f, &p, end, "{\"m\":\"}{\\\"}\"}");
+    PASS();
+}
+
+void test_ndjson() {
+    TEST("NDJSON lines");
+    const char *stream = "{\"a\":1}\n\n{\"b\":2}\r\n{\"c\":";
+    const char *p = stream, *end = stream + strlen(stream);
+    jet_framer f;
+    jet_frame_init(&f, '\n', 64);
+
+    assert_record(&f, &p, end, "{\"a\":1}");
+    assert_record(&f, &p, end, "{\"b\":2}");
+    assert_no_record(&f, p, end);
+    PASS();
+}
+
+void test_resume_straddling() {
+    TEST("Record straddling two reads");
+    const char *reads[] = { "{\"a\":1}{\"b\":\"x}", "y\",\"c\":{\"d\":2}}{\"e\":3}" };
+    char buf[64];
+    size_t len = 0;
+    const char *rec;
+    size_t rec_len;
+    jet_framer f;
+    jet_frame_init(&f, 0, 64);
+
+    memcpy(buf, reads[0], strlen(reads[0]));
+    len = strlen(reads[0]);
+    if (jet_frame(&f, buf, len, &rec, &rec_len) != JET_OK) FAIL("First record missing");
+    const char *p = rec + rec_len;
+    if (jet_frame(&f, p, len - (size_t)(p - buf), &rec, &rec_len) != JET_TRUNCATED) {
+        FAIL("Expected partial record");
+    }
+
+    // Keep the partial record, append the next read
+    memmove(buf, rec, rec_len);
+    len = rec_len;
+    memcpy(buf + len, reads[1], strlen(reads[1]));
+    len += strlen(reads[1]);
+
+    if (jet_frame(&f, buf, len, &rec, &rec_len) != JET_OK) FAIL("Resumed record missing");
+    const char *expected = "{\"b\":\"x}y\",\"c\":{\"d\":2}}";
+    if (rec_len != strlen(expected) || memcmp(rec, expected, rec_len) != 0) {
+        printf("    Got: '%.*s'\n", (int)rec_len, rec);
+        FAIL("Resumed record mismatch");
+    }
+    p = rec + rec_len;
+    if (jet_frame(&f, p, len - (size_t)(p - buf), &rec, &rec_len) != JET_OK) FAIL("Last record missing");
+    if (rec_len != 7) FAIL("Last record length");
+    PASS();
+}
+
+void test_extract_in_place() {
+    TEST("Extract within record bounds");
+    const char *stream = "{\"temp\":21}{\"hum\":40,\"temp\":22}";
+    const char *rec;
+    size_t rec_len;
+    char val[16];
+    jet_framer f;
+    jet_frame_init(&f, 0, 64);
+
+    if (jet_frame(&f, stream, strlen(stream), &rec, &rec_len) != JET_OK) FAIL("Record missing");
+
+    if (jet_n(rec, rec_len, "hum", val, sizeof(val)) != JET_KEY_MISSING) {
+        FAIL("Key from next record must not match");
+    }
+    if (jet_n(rec, rec_len, "temp", val, sizeof(val)) != JET_OK) FAIL("Expected JET_OK");
+    if (strcmp(val, "21") != 0) FAIL("Value mismatch");
+    if (jet_tiny_n(rec, 9, "\"temp\":", val, sizeof(val)) != JET_OK) FAIL("Bounded value");
+    if (strcmp(val, "2") != 0) FAIL("Value must stop at record end");
+    PASS();
+}
+
+void test_noise_recovery() {
+    TEST("Brace mode recovers from line noise");
+    const char *stream = "xx\"{\"}{\"a\":1}";
+    const char *p = stream, *end = stream + strlen(stream);
+    const char *rec;
+    size_t rec_len;
+    jet_framer f;
+    jet_frame_init(&f, 0, 8);
+
+    if (jet_frame(&f, p, (size_t)(end - p), &rec, &rec_len) != JET_MALFORMED) FAIL("Expected JET_MALFORMED");
+    if (rec != stream + 3 || rec_len != 1) FAIL("Must drop only the bad '{'");
+    p = rec + rec_len;
+    assert_record(&f, &p, end, "{\"a\":1}");
+    PASS();
+}
+
+void test_oversized_split() {
+    TEST("Oversized record across reads");
+    const char *rec;
+    size_t rec_len;
+    jet_framer f;
+    jet_frame_init(&f, 0, 8);
+
+    if (jet_frame(&f, "{\"a\":\"", 6, &rec, &rec_len) != JET_TRUNCATED) FAIL("Expected partial");
+    if (jet_frame(&f, "{\"a\":\"xyz", 9, &rec, &rec_len) != JET_MALFORMED) FAIL("Expected JET_MALFORMED");
+    if (rec_len != 1) FAIL("Must drop the '{'");
+    PASS();
+}
+
+void test_ndjson_long_line() {
+    TEST("NDJSON line longer than max_len is dropped");
+    const char *stream = "{\"a\":123456789}\n{\"b\":2}\n";
+    const char *p = stream, *end = stream + strlen(stream);
+    const char *rec;
+    size_t rec_len;
+    jet_framer f;
+    jet_frame_init(&f, '\n', 8);
+
+    if (jet_frame(&f, p, (size_t)(end - p), &rec, &rec_len) != JET_MALFORMED) FAIL("Expected JET_MALFORMED");
+    p = rec + rec_len;
+    assert_record(&f, &p, end, "{\"b\":2}");
+
+    // Rest of the long line arrives in a later read
+    jet_frame_init(&f, '\n', 8);
+    if (jet_frame(&f, "{\"a\":123456789", 15, &rec, &rec_len) != JET_MALFORMED) FAIL("Expected JET_MALFORMED");
+    if (jet_frame(&f, "999", 3, &rec, &rec_len) != JET_TRUNCATED || rec_len != 0) FAIL("Still dropping");
+    p = "0}\n{\"c\":3}\n";
+    assert_record(&f, &p, p + strlen(p), "{\"c\":3}");
+    PASS();
+}
+
+int main(void) {
+    printf("=== Packet Atoms Framing Tests ===\n\n");
+
+    test_concatenated();
+    test_nested_and_strings();
+    test_ndjson();
+    test_resume_straddling();
+    test_extract_in_place();
+    test_noise_recovery();
+    test_oversized_split();
+    test_ndjson_long_line();
+
+    printf("\n=== ALL FRAMING TESTS PASSED ===\n");
+    return 0;
+}
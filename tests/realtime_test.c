@@ -0,0 +1,73 @@
+// realtime_test.c - Bounded-time extraction with scan budgets
+// Compile: gcc -Wall -Wextra -Werror -std=c99 -o realtime_test realtime_test.c
+// Run: ./realtime_test
+
+#define PACKET_ATOMS_RT
+#include "packet_atoms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name) printf("TEST: %s\n", name)
+#define PASS() printf("  ✓ PASS\n")
+#define FAIL(msg) do { printf("  ✗ FAIL: %s\n", msg); exit(1); } while(0)
+
+// Test helpers
+void assert_rt(const char *json, const char *needle, size_t budget,
+               jet_err expected_err, const char *expected) {
+    char buf[16];
+    jet_err err = jet_tiny_rt(json, needle, buf, sizeof(buf), budget);
+    if (err != expected_err) {
+        printf("    JSON: %s budget=%u\n    Expected error %d, Got %d\n",
+               json, (unsigned)budget, expected_err, err);
+        FAIL("Error code mismatch");
+    }
+    if (expected && strcmp(buf, expected) != 0) {
+        printf("    Expected: '%s', Got: '%s'\n", expected, buf);
+        FAIL("Value mismatch");
+    }
+}
+
+// Test cases
+void test_matches_jet_tiny() {
+    TEST("Same results as jet_tiny within budget");
+    assert_rt("{\"temp\":22.5,\"hum\":65}", "\"temp\":", 64, JET_OK, "22.5");
+    assert_rt("{\"temp\":22.5,\"hum\":65}", "\"hum\":", 64, JET_OK, "65");
+    assert_rt("{\"temp\": 22.5}", "\"temp\":", 64, JET_OK, "22.5");
+    assert_rt("{\"temp\":22}", "\"hum\":", 64, JET_KEY_MISSING, NULL);
+    assert_rt("{\"x\":}", "\"x\":", 64, JET_MALFORMED, NULL);
+    assert_rt("{\"x\":12345678901234567890}", "\"x\":", 64, JET_TRUNCATED, NULL);
+    PASS();
+}
+
+void test_budget_exceeded() {
+    TEST("Budget used up");
+    const char *json = "{\"temp\":22.5,\"hum\":65}";
+    assert_rt(json, "\"hum\":", 14, JET_BUDGET_EXCEEDED, NULL);   // Needle cut by budget
+    assert_rt(json, "\"temp\":", 10, JET_BUDGET_EXCEEDED, NULL);  // Value cut by budget
+    assert_rt(json, "\"temp\":", 12, JET_BUDGET_EXCEEDED, NULL);  // Value end not seen
+    assert_rt(json, "\"temp\":", 13, JET_OK, "22.5");             // ',' is byte 12
+    assert_rt(json, "\"temp\":", 0, JET_BUDGET_EXCEEDED, NULL);
+    PASS();
+}
+
+void test_unterminated_input() {
+    TEST("Unterminated input stays inside budget");
+    char rx[16];
+    memset(rx, 'A', sizeof(rx));  // No NUL, no key
+    memcpy(rx, "{\"temp\":", 8);
+    assert_rt(rx, "\"hum\":", sizeof(rx), JET_BUDGET_EXCEEDED, NULL);
+    assert_rt(rx, "\"temp\":", sizeof(rx), JET_BUDGET_EXCEEDED, NULL);
+    PASS();
+}
+
+int main(void) {
+    printf("=== Packet Atoms Real-Time Tests ===\n\n");
+
+    test_matches_jet_tiny();
+    test_budget_exceeded();
+    test_unterminated_input();
+
+    printf("\n=== ALL REAL-TIME TESTS PASSED ===\n");
+    return 0;
+}
@@ -25,6 +25,15 @@ void test_tlv_only(void) {
     tlv(data, sizeof(data), 0x01, &len);
 }
 
+#ifdef PACKET_ATOMS_RT
+// Test function that only uses jet_tiny_rt
+void test_jet_tiny_rt_only(void) {
+    const char *json = "{\"temp\":22.5}";
+    char buf[16];
+    jet_tiny_rt(json, "\"temp\":", buf, sizeof(buf), 64);
+}
+#endif
+
 // Test all three functions
 void test_all(void) {
     const char *json = "{\"temp\":22.5}";